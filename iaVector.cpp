@@ -47,6 +47,8 @@
  *                   - double iaVector::minElement() const; // Вычисление минимального элемента
  *                   - double iaVector::angleBetween(const iaVector& otherVector) const noexcept; // Вычисление угла между векторами
  *                   - void iaVector::inverting() noexcept; // Инверсия вектора
+ *                   - iaVector::iaVector(int m, iaAllocation mode, int threads); // Конструктор с huge pages / NUMA
+ *                   - int iaVector::numaNodeOf(int j) const noexcept; // NUMA-узел элемента j
  *
  *    @properties  :
  *                   - int m;            ///< Размер вектора
@@ -59,6 +61,390 @@
  */\
 #include "iaVector.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const std::size_t kDefaultHugePageSize = 2 * 1024 * 1024; ///< Размер huge page, если ядро его не сообщает
+const std::size_t kParallelMinBytes = 8 * 1024 * 1024; ///< Меньшие векторы HugePages выделяются через new[]
+
+/**
+ * @brief Разбирает список CPU или узлов в формате ядра ("0-3,8,10-11").
+ * @return Номера из списка; пустой вектор, если файл не прочитан.
+ */
+std::vector<int> readList(const char* path) {
+    std::vector<int> result;
+    std::ifstream file(path);
+    std::string item;
+    while (std::getline(file, item, ',')) {
+        int first = 0, last = 0;
+        int fields = std::sscanf(item.c_str(), "%d-%d", &first, &last);
+        if (fields < 1) continue;
+        if (fields == 1) last = first;
+        for (int i = first; i <= last; i++) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+/**
+ * @class PinnedPool
+ * @brief Пул потоков процесса, каждый поток привязан к одному разрешённому CPU.
+ *
+ * Потоки создаются один раз и упорядочены по NUMA-узлам по кругу (узел 0, узел 1, ...,
+ * снова узел 0), поэтому первые N потоков, которые берёт вектор, распределены по сокетам.
+ * First-touch и все последующие редукции выполняет один и тот же поток на одном и том же
+ * CPU, и блок t читается с того NUMA-узла, на котором он был размещён.
+ */
+class PinnedPool {
+public:
+    static PinnedPool& instance() {
+        static PinnedPool pool;
+        return pool;
+    }
+    
+    ~PinnedPool() {
+        stop();
+    }
+    
+    int size() const noexcept { return static_cast<int>(workers.size()); } // Число потоков пула
+    bool pinned() const noexcept { return allPinned; } // Все ли потоки удалось привязать к CPU
+    int nodeOf(int t) const noexcept { return nodes[t]; } // NUMA-узел CPU потока t (-1, если неизвестен)
+    
+    /**
+     * @brief Выполняет body(t) для t = 0 .. threads-1 в потоках пула и ждёт завершения.
+     * Пул выполняет одну задачу за раз; вызов ждёт, пока пул освободится.
+     * @param threads Число задействованных потоков, 1 <= threads <= size().
+     * @param body Функция, которая не должна выбрасывать исключений.
+     */
+    void run(int threads, const std::function<void(int)>& body) {
+        std::lock_guard<std::mutex> serial(runMutex);
+        dispatch(threads, body);
+    }
+    
+    /**
+     * @brief То же, что run(), но не ждёт занятый пул.
+     * @return false, если пул занят задачей другого потока и body не выполнялась.
+     */
+    bool tryRun(int threads, const std::function<void(int)>& body) {
+        std::unique_lock<std::mutex> serial(runMutex, std::try_to_lock);
+        if (!serial.owns_lock()) {
+            return false;
+        }
+        dispatch(threads, body);
+        return true;
+    }
+    
+private:
+    PinnedPool() {
+        std::vector<int> cpus = orderedCpus();
+        workers.reserve(cpus.size());
+        nodes.reserve(cpus.size());
+        try {
+            for (int cpu : cpus) {
+                int node = cpu < 0 ? -1 : nodeOfCpu(cpu);
+                workers.emplace_back(&PinnedPool::work, this, size());
+                allPinned = pinThread(workers.back(), cpu) && allPinned;
+                nodes.push_back(node); // Не бросает: память зарезервирована
+            }
+        } catch (...) {
+            // std::system_error или std::bad_alloc: пул работает с уже созданными потоками
+        }
+    }
+    
+    PinnedPool(const PinnedPool&) = delete;
+    PinnedPool& operator=(const PinnedPool&) = delete;
+    
+    /**
+     * @brief Останавливает и присоединяет все запущенные потоки.
+     */
+    void stop() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+    
+    void dispatch(int threads, const std::function<void(int)>& body) {
+        std::unique_lock<std::mutex> lock(mutex);
+        task = &body;
+        taskThreads = threads;
+        pending = threads;
+        generation++;
+        wake.notify_all();
+        done.wait(lock, [this]() { return pending == 0; });
+        task = nullptr;
+    }
+    
+    /**
+     * @brief NUMA-узел, которому принадлежит CPU.
+     * @return Номер узла или -1, если топология недоступна.
+     */
+    static int nodeOfCpu(int cpu) {
+        for (int node : readList("/sys/devices/system/node/online")) {
+            std::ostringstream path;
+            path << "/sys/devices/system/node/node" << node << "/cpulist";
+            std::vector<int> cpus = readList(path.str().c_str());
+            if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end()) {
+                return node;
+            }
+        }
+        return -1;
+    }
+    
+    /**
+     * @brief CPU, разрешённые процессу (маска affinity и cpuset), по кругу по NUMA-узлам.
+     * @return Номера CPU; -1 означает поток без привязки, если маску получить не удалось.
+     */
+    static std::vector<int> orderedCpus() {
+        std::vector<std::vector<int>> byNode; // Разрешённые CPU, сгруппированные по узлам
+        std::vector<int> nodeIds;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if (!CPU_ISSET(cpu, &set)) continue;
+                int node = nodeOfCpu(cpu);
+                std::size_t group = std::find(nodeIds.begin(), nodeIds.end(), node) - nodeIds.begin();
+                if (group == nodeIds.size()) {
+                    nodeIds.push_back(node);
+                    byNode.emplace_back();
+                }
+                byNode[group].push_back(cpu);
+            }
+        }
+#endif
+        std::vector<int> cpus;
+        for (std::size_t round = 0; ; round++) {
+            bool any = false;
+            for (const std::vector<int>& group : byNode) {
+                if (round < group.size()) {
+                    cpus.push_back(group[round]);
+                    any = true;
+                }
+            }
+            if (!any) break;
+        }
+        if (cpus.empty()) {
+            cpus.assign(std::max(1u, std::thread::hardware_concurrency()), -1);
+        }
+        return cpus;
+    }
+    
+    /**
+     * @brief Привязывает поток к CPU.
+     * @return true, если привязка выполнена.
+     */
+    static bool pinThread(std::thread& worker, int cpu) noexcept {
+#if defined(__linux__)
+        if (cpu < 0) return false;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return pthread_setaffinity_np(worker.native_handle(), sizeof(set), &set) == 0;
+#else
+        (void)worker;
+        (void)cpu;
+        return false;
+#endif
+    }
+    
+    void work(int id) {
+        unsigned long seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            if (id < taskThreads) {
+                const std::function<void(int)>* body = task;
+                lock.unlock();
+                (*body)(id);
+                lock.lock();
+                if (--pending == 0) {
+                    done.notify_one();
+                }
+            }
+        }
+    }
+    
+    std::vector<std::thread> workers; ///< Потоки пула
+    std::vector<int> nodes; ///< NUMA-узел CPU каждого потока
+    bool allPinned = true; ///< Все потоки привязаны к своим CPU
+    std::mutex runMutex; ///< Сериализует задачи пула
+    std::mutex mutex; ///< Защищает поля задачи ниже
+    std::condition_variable wake; ///< Сигнал потокам о новой задаче
+    std::condition_variable done; ///< Сигнал о завершении задачи
+    const std::function<void(int)>* task = nullptr; ///< Текущая задача
+    int taskThreads = 0; ///< Число потоков текущей задачи
+    int pending = 0; ///< Сколько потоков ещё не завершили задачу
+    unsigned long generation = 0; ///< Номер текущей задачи
+    bool stopping = false; ///< Пул останавливается
+};
+
+#if defined(__linux__)
+/**
+ * @brief Размер явной huge page по умолчанию (Hugepagesize из /proc/meminfo).
+ * @return Размер в байтах или 0, если явные huge pages не поддерживаются.
+ */
+std::size_t explicitHugePageSize() {
+    static const std::size_t size = []() -> std::size_t {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string line;
+        unsigned long kb = 0;
+        while (std::getline(meminfo, line)) {
+            if (std::sscanf(line.c_str(), "Hugepagesize: %lu kB", &kb) == 1) {
+                return static_cast<std::size_t>(kb) * 1024;
+            }
+        }
+        return 0;
+    }();
+    return size;
+}
+
+/**
+ * @brief Размер transparent huge page (hpage_pmd_size).
+ * @return Размер в байтах; kDefaultHugePageSize, если ядро его не сообщает.
+ */
+std::size_t transparentHugePageSize() {
+    static const std::size_t size = []() -> std::size_t {
+        std::ifstream pmd("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+        unsigned long bytes = 0;
+        if (pmd >> bytes && bytes != 0) {
+            return static_cast<std::size_t>(bytes);
+        }
+        return kDefaultHugePageSize;
+    }();
+    return size;
+}
+
+/**
+ * @brief Размер охранной страницы вокруг THP-отображения (размер обычной страницы).
+ */
+std::size_t guardSize() noexcept {
+    static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+/**
+ * @brief Округляет bytes вверх до кратного align.
+ */
+std::size_t roundUp(std::size_t bytes, std::size_t align) noexcept {
+    return (bytes + align - 1) / align * align;
+}
+
+/**
+ * @brief Отображает length байт анонимной памяти с началом, выровненным на align.
+ *
+ * Отображение берётся с запасом; по одной странице PROT_NONE остаётся с каждой стороны,
+ * чтобы ядро не сливало его с соседними отображениями и AnonHugePages относился только
+ * к этому вектору. Остальной запас освобождается.
+ *
+ * @return Адрес выровненного начала или MAP_FAILED.
+ */
+void* mapAligned(std::size_t length, std::size_t align) noexcept {
+    std::size_t guard = guardSize();
+    std::size_t total = length + align + 2 * guard;
+    void* raw = mmap(nullptr, total, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return MAP_FAILED;
+    }
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(raw);
+    std::uintptr_t aligned = roundUp(start + guard, align);
+    if (mprotect(reinterpret_cast<void*>(aligned), length, PROT_READ | PROT_WRITE) != 0) {
+        munmap(raw, total);
+        return MAP_FAILED;
+    }
+    if (aligned - guard > start) {
+        munmap(raw, aligned - guard - start); // Лишнее в начале
+    }
+    std::uintptr_t end = aligned + length + guard;
+    if (start + total > end) {
+        munmap(reinterpret_cast<void*>(end), start + total - end); // Лишнее в конце
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+/**
+ * @brief Объём transparent huge pages в диапазоне [begin, begin + length) по /proc/self/smaps.
+ * Учитываются только отображения, целиком лежащие внутри диапазона.
+ * @return Объём в кБ; 0, если huge pages не выделены или smaps недоступен.
+ */
+unsigned long anonHugePagesKb(const void* begin, std::size_t length) {
+    std::ifstream smaps("/proc/self/smaps");
+    std::string line;
+    unsigned long first = reinterpret_cast<std::uintptr_t>(begin);
+    unsigned long last = first + length;
+    unsigned long total = 0;
+    bool inside = false;
+    while (std::getline(smaps, line)) {
+        unsigned long lo = 0, hi = 0, kb = 0;
+        if (std::sscanf(line.c_str(), "%lx-%lx ", &lo, &hi) == 2) {
+            inside = first <= lo && hi <= last; // Заголовок нового отображения
+        } else if (inside && std::sscanf(line.c_str(), "AnonHugePages: %lu kB", &kb) == 1) {
+            total += kb;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Проверяет, что все страницы диапазона [begin, end) размещены на узле node.
+ * Использует move_pages(2) в режиме запроса.
+ */
+bool pagesOnNode(const double* begin, const double* end, std::size_t pageBytes, int node) {
+#if defined(SYS_move_pages)
+    if (node < 0) {
+        return false;
+    }
+    std::vector<void*> pages;
+    const char* last = reinterpret_cast<const char*>(end) - 1;
+    for (const char* p = reinterpret_cast<const char*>(begin); p <= last; p += pageBytes) {
+        pages.push_back(const_cast<char*>(p));
+    }
+    std::vector<int> status(pages.size(), -1);
+    if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0) {
+        return false;
+    }
+    return std::all_of(status.begin(), status.end(), [node](int s) { return s == node; });
+#else
+    (void)begin;
+    (void)end;
+    (void)pageBytes;
+    (void)node;
+    return false;
+#endif
+}
+#endif
+
+} // namespace
+
 /**
  * @brief Конструктор по умолчанию.
  * Инициализирует вектор с размером 0 и нулевым указателем на значения.
@@ -85,16 +471,41 @@ iaVector::iaVector(int m, const double values[]) : m(m), value(nullptr) {
     }
 }
 
+/**
+ * @brief Конструктор с заданным размером и режимом выделения памяти.
+ *
+ * В режиме HugePages память выделяется через mmap с MAP_HUGETLB; если явных huge pages
+ * нет, используется выровненный mmap с madvise(MADV_HUGEPAGE), а если и mmap недоступен -
+ * обычный new[]. Векторы меньше kParallelMinBytes или меньше одной huge page всегда
+ * выделяются через new[]. Фактический результат можно узнать через pageKind() и isNodeLocal().
+ *
+ * @param m Размер вектора.
+ * @param mode Режим выделения памяти.
+ * @param threads Число потоков для first-touch и редукций (0 - по числу разрешённых CPU).
+ *                Ограничивается числом потоков пула и числом huge pages.
+ */
+iaVector::iaVector(int m, iaAllocation mode, int threads) : value(nullptr), m(m), mode(mode), threads(threads) {
+    if (m > 0) {
+        allocate();
+    } else {
+        this->threads = 1;
+    }
+}
+
 /**
  * @brief Конструктор копирования.
+ * Копия сохраняет режим выделения памяти и число потоков оригинала.
  * @param otherVector Вектор, который будет скопирован.
  */
-iaVector::iaVector(const iaVector& otherVector) : m(otherVector.m), value(nullptr) {
+iaVector::iaVector(const iaVector& otherVector)
+    : value(nullptr), m(otherVector.m), mode(otherVector.mode), threads(otherVector.threads) {
     if (m > 0) {
-        value = new double[m](); // Выделение памяти для значений
-        for (int i = 0; i < m; i++) {
-            value[i] = otherVector.value[i]; // Копирование значений
-        }
+        allocate(); // Выделение памяти для значений
+        forChunks([&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                value[i] = otherVector.value[i]; // Копирование значений
+            }
+        });
     }
 }
 
@@ -103,7 +514,238 @@ iaVector::iaVector(const iaVector& otherVector) : m(otherVector.m), value(nullpt
  * Освобождает выделенную память для значений вектора.
  */
 iaVector::~iaVector() {
-    delete[] value; // Освобождение памяти
+    release(); // Освобождение памяти
+}
+
+/**
+ * @brief Выделяет память под m значений согласно режиму mode.
+ *
+ * В режиме HugePages поток пула t обнуляет свой блок [chunkBegin(t), chunkEnd(t)),
+ * состоящий из целых huge pages, после чего проверяется, что страницы блока
+ * действительно оказались на NUMA-узле этого потока.
+ */
+void iaVector::allocate() {
+#if defined(__linux__)
+    std::size_t bytes = static_cast<std::size_t>(m) * sizeof(double);
+    if (mode == iaAllocation::HugePages && bytes >= kParallelMinBytes) {
+        PinnedPool& pool = PinnedPool::instance();
+        void* p = MAP_FAILED;
+        
+        std::size_t explicitSize = explicitHugePageSize();
+        if (explicitSize != 0 && bytes >= explicitSize) {
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+            int shift = 0;
+            while ((std::size_t(1) << shift) < explicitSize) shift++;
+            flags |= shift << MAP_HUGE_SHIFT; // Размер страницы указывается явно
+#endif
+            p = mmap(nullptr, roundUp(bytes, explicitSize), PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (p != MAP_FAILED) {
+                pages = iaPageKind::Explicit;
+                pageBytes = explicitSize;
+            }
+        }
+        std::size_t thpSize = transparentHugePageSize();
+        if (p == MAP_FAILED && bytes >= thpSize) {
+            p = mapAligned(roundUp(bytes, thpSize), thpSize);
+            if (p != MAP_FAILED) {
+                madvise(p, roundUp(bytes, thpSize), MADV_HUGEPAGE); // Только совет ядру, см. pageKind()
+                pages = iaPageKind::Regular;
+                pageBytes = thpSize;
+            }
+        }
+        
+        if (p != MAP_FAILED) {
+            value = static_cast<double*>(p);
+            mappedBytes = roundUp(bytes, pageBytes);
+            
+            int pageCount = static_cast<int>(std::min<std::size_t>(mappedBytes / pageBytes, pool.size()));
+            if (threads <= 0 || threads > pageCount) {
+                threads = pageCount; // Не больше потоков пула и не меньше одной страницы на поток
+            }
+            threads = std::max(threads, 1);
+            
+            try {
+                if (threads > 1) {
+                    pool.run(threads, [this](int t) {
+                        std::fill(value + chunkBegin(t), value + chunkEnd(t), 0.0); // First-touch
+                    });
+                } else {
+                    std::fill(value, value + m, 0.0);
+                }
+            } catch (...) {
+                release(); // Деструктор не будет вызван
+                throw;
+            }
+            
+            nodeLocal = threads > 1 && pool.pinned();
+            for (int t = 0; nodeLocal && t < threads; t++) {
+                nodeLocal = pagesOnNode(value + chunkBegin(t), value + chunkEnd(t), pageBytes, pool.nodeOf(t));
+            }
+            return;
+        }
+        pageBytes = 0;
+    }
+#endif
+    threads = 1;
+    pages = iaPageKind::Regular;
+    value = new double[m](); // Выделение памяти для значений и инициализация нулями
+}
+
+/**
+ * @brief Освобождает память согласно способу её выделения.
+ */
+void iaVector::release() noexcept {
+#if defined(__linux__)
+    if (mappedBytes != 0) {
+        std::size_t guard = pages == iaPageKind::Explicit ? 0 : guardSize(); // Охранные страницы mapAligned()
+        munmap(reinterpret_cast<char*>(value) - guard, mappedBytes + 2 * guard);
+        mappedBytes = 0;
+        value = nullptr;
+        return;
+    }
+#endif
+    delete[] value;
+    value = nullptr;
+}
+
+/**
+ * @brief Выполняет body(t, begin, end) для каждого блока вектора.
+ *
+ * Блоки обрабатываются потоками пула, которые выполняли first-touch. Если пул занят
+ * задачей другого потока, блоки обрабатываются в вызывающем потоке, чтобы параллельные
+ * обходы разных векторов не ждали друг друга.
+ */
+template <typename F>
+void iaVector::forChunks(F body) const {
+    if (threads > 1) {
+        bool ran = PinnedPool::instance().tryRun(threads, [&](int t) {
+            body(t, chunkBegin(t), chunkEnd(t));
+        });
+        if (ran) {
+            return;
+        }
+    }
+    for (int t = 0; t < threads; t++) {
+        body(t, chunkBegin(t), chunkEnd(t));
+    }
+}
+
+/**
+ * @brief Редукция по тем же блокам и на тех же потоках, что и при first-touch.
+ * @param partial Функция partial(begin, end), возвращающая частичный результат блока.
+ * @param combine Функция combine(a, b), объединяющая частичные результаты.
+ * @return Объединённый результат; не зависит от того, выполнялись ли блоки параллельно.
+ */
+template <typename F, typename C>
+double iaVector::reduce(F partial, C combine) const {
+    if (threads <= 1) {
+        return partial(0, m);
+    }
+    std::vector<double> partials(threads, 0.0);
+    forChunks([&](int t, int begin, int end) {
+        partials[t] = partial(begin, end);
+    });
+    double result = partials[0];
+    for (int t = 1; t < threads; t++) {
+        result = combine(result, partials[t]);
+    }
+    return result;
+}
+
+/**
+ * @brief Возвращает запрошенный режим выделения памяти.
+ * @return Режим выделения памяти.
+ */
+iaAllocation iaVector::allocation() const noexcept {
+    return mode;
+}
+
+/**
+ * @brief Возвращает фактический тип страниц.
+ *
+ * Для THP-отображения при каждом вызове читается /proc/self/smaps (только диапазон
+ * этого вектора), так как ядро может выделить или собрать huge pages позже.
+ *
+ * @return Regular, Transparent или Explicit.
+ */
+iaPageKind iaVector::pageKind() const {
+#if defined(__linux__)
+    if (pages == iaPageKind::Regular && mappedBytes != 0 && anonHugePagesKb(value, mappedBytes) > 0) {
+        return iaPageKind::Transparent;
+    }
+#endif
+    return pages;
+}
+
+/**
+ * @brief Возвращает размер страницы, по которому выровнены блоки потоков.
+ * @return Размер huge page в байтах или 0, если память выделена через new[].
+ */
+std::size_t iaVector::pageSize() const noexcept {
+    return pageBytes;
+}
+
+/**
+ * @brief Показывает, размещены ли блоки на NUMA-узлах потоков, которые их читают.
+ * @return true, если first-touch выполнен несколькими привязанными к CPU потоками и
+ *         все страницы каждого блока проверены через move_pages(2) на узле своего потока.
+ */
+bool iaVector::isNodeLocal() const noexcept {
+    return nodeLocal;
+}
+
+/**
+ * @brief Возвращает число потоков, используемых для first-touch и редукций.
+ * @return Число потоков (блоков).
+ */
+int iaVector::threadCount() const noexcept {
+    return threads;
+}
+
+/**
+ * @brief Начало блока, который обрабатывает поток t.
+ * Границы блоков кратны размеру huge page, так что каждая страница принадлежит одному потоку.
+ * @param t Номер потока, 0 <= t <= threadCount().
+ * @return Индекс первого элемента блока (m для t == threadCount()).
+ */
+int iaVector::chunkBegin(int t) const noexcept {
+    if (threads <= 1) {
+        return t <= 0 ? 0 : m;
+    }
+    std::size_t pageElements = pageBytes / sizeof(double);
+    std::size_t pageCount = (static_cast<std::size_t>(m) + pageElements - 1) / pageElements;
+    std::size_t begin = pageCount * t / threads * pageElements;
+    return static_cast<int>(std::min<std::size_t>(begin, m));
+}
+
+/**
+ * @brief Конец блока, который обрабатывает поток t.
+ * @param t Номер потока, 0 <= t < threadCount().
+ * @return Индекс элемента, следующего за последним элементом блока.
+ */
+int iaVector::chunkEnd(int t) const noexcept {
+    return chunkBegin(t + 1);
+}
+
+/**
+ * @brief Определяет NUMA-узел, на котором размещена страница элемента j.
+ * Использует move_pages(2) в режиме запроса (без перемещения страниц).
+ * @param j Индекс элемента.
+ * @return Номер NUMA-узла или -1, если узел неизвестен или индекс вне пределов.
+ */
+int iaVector::numaNodeOf(int j) const noexcept {
+    if (j < 0 || j >= m) {
+        return -1;
+    }
+#if defined(__linux__) && defined(SYS_move_pages)
+    void* page = static_cast<void*>(value + j);
+    int status = -1;
+    if (syscall(SYS_move_pages, 0, 1UL, &page, nullptr, &status, 0) == 0 && status >= 0) {
+        return status;
+    }
+#endif
+    return -1;
 }
 
 /**
@@ -131,11 +773,13 @@ void iaVector::printVector() const {
  * @return Сумма элементов вектора.
  */
 double iaVector::sum() const {
-    double sum = 0.0; // Переменная для хранения суммы
-    for (int i = 0; i < m; i++) {
-        sum += value[i]; // Суммируем элементы вектора
-    }
-    return sum; // Возвращаем сумму
+    return reduce([this](int begin, int end) {
+        double sum = 0.0; // Переменная для хранения суммы
+        for (int i = begin; i < end; i++) {
+            sum += value[i]; // Суммируем элементы вектора
+        }
+        return sum; // Возвращаем сумму блока
+    }, std::plus<double>());
 }
 
 /**
@@ -143,10 +787,13 @@ double iaVector::sum() const {
  * @return L2 норма вектора.
  */
 double iaVector::L2norm() const {
-    double sum = 0.0; // Переменная для хранения суммы квадратов
-    for (int i = 0; i < m; i++) {
-        sum += value[i] * value[i]; // Суммируем квадраты элементов
-    }
+    double sum = reduce([this](int begin, int end) {
+        double sum = 0.0; // Переменная для хранения суммы квадратов
+        for (int i = begin; i < end; i++) {
+            sum += value[i] * value[i]; // Суммируем квадраты элементов
+        }
+        return sum;
+    }, std::plus<double>());
     return sqrt(sum); // Возвращаем квадратный корень из суммы
 }
 
@@ -155,11 +802,13 @@ double iaVector::L2norm() const {
  * @return L1 норма вектора.
  */
 double iaVector::L1norm() const {
-    double sum = 0.0; // Переменная для хранения суммы абсолютных значений
-    for (int i = 0; i < m; i++) {
-        sum += abs(value[i]); // Суммируем абсолютные значения элементов
-    }
-    return sum; // Возвращаем сумму
+    return reduce([this](int begin, int end) {
+        double sum = 0.0; // Переменная для хранения суммы абсолютных значений
+        for (int i = begin; i < end; i++) {
+            sum += abs(value[i]); // Суммируем абсолютные значения элементов
+        }
+        return sum; // Возвращаем сумму блока
+    }, std::plus<double>());
 }
 /*
 iaVector iaVector::normalize() {
@@ -171,13 +820,15 @@ iaVector iaVector::normalize() {
  * @return L∞ норма вектора.
  */
 double iaVector::LMnorm() const {
-    double max = abs(value[0]); // Инициализируем максимальное значение первым элементом
-    for (int i = 1; i < m; i++) { // Начинаем с 1, так как 0 уже учтён
-        if (abs(value[i]) > max) {
-            max = abs(value[i]); // Обновляем максимальное значение
+    return reduce([this](int begin, int end) {
+        double max = abs(value[begin]); // Инициализируем максимальное значение первым элементом блока
+        for (int i = begin + 1; i < end; i++) { // Начинаем со второго, так как первый уже учтён
+            if (abs(value[i]) > max) {
+                max = abs(value[i]); // Обновляем максимальное значение
+            }
         }
-    }
-    return max; // Возвращаем максимальное значение
+        return max; // Возвращаем максимальное значение блока
+    }, [](double a, double b) { return std::max(a, b); });
 }
 
 /**
@@ -191,11 +842,13 @@ double iaVector::dotProduct(const iaVector &otherVector) const {
         throw std::runtime_error("Ошибка: Размеры векторов не совпадают."); // Выбрасываем исключение
     }
     
-    double result = 0.0; // Переменная для хранения результата
-    for (int i = 0; i < m; i++) {
-        result += value[i] * otherVector.value[i]; // Скалярное произведение
-    }
-    return result; // Возвращаем результат
+    return reduce([this, &otherVector](int begin, int end) {
+        double result = 0.0; // Переменная для хранения результата
+        for (int i = begin; i < end; i++) {
+            result += value[i] * otherVector.value[i]; // Скалярное произведение
+        }
+        return result; // Возвращаем результат блока
+    }, std::plus<double>());
 }
 
 /**
@@ -280,13 +933,15 @@ double iaVector::maxElement() const {
         throw std::runtime_error("Ошибка: Вектор пуст."); // Выбрасываем исключение
     }
     
-    double max = this->value[0]; // Инициализация максимального элемента
-    for (int i = 1; i < this->m; i++) { // Начинаем с первого элемента
-        if (this->value[i] > max) { // Сравниваем с текущим максимальным
-            max = this->value[i]; // Обновляем максимальный элемент
+    return reduce([this](int begin, int end) {
+        double max = this->value[begin]; // Инициализация максимального элемента блока
+        for (int i = begin + 1; i < end; i++) { // Начинаем со второго элемента блока
+            if (this->value[i] > max) { // Сравниваем с текущим максимальным
+                max = this->value[i]; // Обновляем максимальный элемент
+            }
         }
-    }
-    return max; // Возвращаем максимальный элемент
+        return max; // Возвращаем максимальный элемент блока
+    }, [](double a, double b) { return std::max(a, b); });
 }
 
 /**
@@ -300,22 +955,27 @@ double iaVector::minElement() const {
         throw std::runtime_error("Ошибка: Вектор пуст."); // Выбрасываем исключение
     }
     
-    double min = this->value[0]; // Инициализация минимального элемента
-    for (int i = 1; i < this->m; i++) { // Начинаем с первого элемента
-        if (this->value[i] < min) { // Сравниваем с текущим минимальным
-            min = this->value[i]; // Обновляем минимальный элемент
+    return reduce([this](int begin, int end) {
+        double min = this->value[begin]; // Инициализация минимального элемента блока
+        for (int i = begin + 1; i < end; i++) { // Начинаем со второго элемента блока
+            if (this->value[i] < min) { // Сравниваем с текущим минимальным
+                min = this->value[i]; // Обновляем минимальный элемент
+            }
         }
-    }
-    return min; // Возвращаем минимальный элемент
+        return min; // Возвращаем минимальный элемент блока
+    }, [](double a, double b) { return std::min(a, b); });
 }
 
 
 double iaVector::avverage() const {
-    double sum=this->value[0];
+    double sum = reduce([this](int begin, int end) {
+        double sum = this->value[begin];
+        for (int i = begin + 1; i < end; i++) {
+            sum += this->value[i];
+        }
+        return sum;
+    }, std::plus<double>());
     int size = this->m;
-    for (int i = 1; i < this->m; i++) {
-        sum += this->value[i];
-    }
     
     return sum / size;
 }
@@ -342,13 +1002,15 @@ iaVector& iaVector::operator=(const iaVector& otherVector) noexcept {
  * @return Новый вектор, представляющий сумму.
  */
 iaVector iaVector::operator+(const iaVector &otherVector) noexcept {
-    iaVector result(otherVector.m);
+    iaVector result(otherVector.m, mode, threads); // Результат в том же режиме выделения памяти
     if (this->m != otherVector.m) {
         return 0; // Возврат 0, если размеры не совпадают
     } else {
-        for (int j = 0; j < this->m; j++) {
-            result.value[j] = this->value[j] + otherVector.value[j]; // Сложение соответствующих элементов
-        }
+        forChunks([&](int, int begin, int end) {
+            for (int j = begin; j < end; j++) {
+                result.value[j] = this->value[j] + otherVector.value[j]; // Сложение соответствующих элементов
+            }
+        });
     }
     return result;
 }
@@ -359,11 +1021,13 @@ iaVector iaVector::operator+(const iaVector &otherVector) noexcept {
  * @return Новый вектор, представляющий разность.
  */
 iaVector iaVector::operator-(const iaVector &otherVector) noexcept {
-    iaVector result(this->m);
+    iaVector result(this->m, mode, threads); // Результат в том же режиме выделения памяти
     if (this->m == otherVector.m) {
-        for (int i = 0; i < this->m; i++) {
-            result.value[i] = this->value[i] - otherVector.value[i]; // Вычитание соответствующих элементов
-        }
+        forChunks([&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                result.value[i] = this->value[i] - otherVector.value[i]; // Вычитание соответствующих элементов
+            }
+        });
     }
     return result;
 }
@@ -374,11 +1038,13 @@ iaVector iaVector::operator-(const iaVector &otherVector) noexcept {
  * @return Новый вектор, представляющий произведение.
  */
 iaVector iaVector::operator*(const iaVector &otherVector) noexcept {
-    iaVector result(this->m);
+    iaVector result(this->m, mode, threads); // Результат в том же режиме выделения памяти
     if (this->m == otherVector.m) {
-        for (int i = 0; i < this->m; i++) {
-            result.value[i] = this->value[i] * otherVector.value[i]; // Умножение соответствующих элементов
-        }
+        forChunks([&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                result.value[i] = this->value[i] * otherVector.value[i]; // Умножение соответствующих элементов
+            }
+        });
     }
     return result;
 }
@@ -389,10 +1055,12 @@ iaVector iaVector::operator*(const iaVector &otherVector) noexcept {
  * @return Новый вектор, представляющий произведение.
  */
 iaVector iaVector::operator*(double scal) {
-    iaVector result(this->m);
-    for (int i = 0; i < this->m; i++) {
-        result.value[i] = this->value[i] * scal; // Умножение каждого элемента на скаляр
-    }
+    iaVector result(this->m, mode, threads); // Результат в том же режиме выделения памяти
+    forChunks([&](int, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            result.value[i] = this->value[i] * scal; // Умножение каждого элемента на скаляр
+        }
+    });
     return result;
 }
 
@@ -52,6 +52,15 @@
  *                   - double minElement() const; // Вычисление минимального элемента
  *                   - double angleBetween(const iaVector& otherVector) const noexcept; // Вычисление угла между векторами
  *                   - void inverting() noexcept; // Инверсия вектора
+ *                   - iaVector(int m, iaAllocation mode, int threads = 0); // Конструктор с huge pages / NUMA
+ *                   - iaAllocation allocation() const noexcept; // Режим выделения памяти
+ *                   - iaPageKind pageKind() const; // Фактический тип страниц
+ *                   - std::size_t pageSize() const noexcept; // Размер huge page блоков
+ *                   - bool isNodeLocal() const noexcept; // Размещение блоков на NUMA-узлах потоков
+ *                   - int threadCount() const noexcept; // Число потоков first-touch и редукций
+ *                   - int chunkBegin(int t) const noexcept; // Начало блока потока t
+ *                   - int chunkEnd(int t) const noexcept; // Конец блока потока t
+ *                   - int numaNodeOf(int j) const noexcept; // NUMA-узел элемента j
  *
  *    @properties  :
  *                   - int m;            ///< Размер вектора
@@ -70,6 +79,34 @@
 #include <iomanip>
 #include <cmath>
 #include <stdexcept>
+#include <cstddef>
+
+/**
+ * @enum iaAllocation
+ * @brief Режим выделения памяти под значения вектора.
+ *
+ * Standard  - обычный new double[m](), обнуление в вызывающем потоке.
+ * HugePages - память через mmap с huge pages (MAP_HUGETLB, при неудаче - THP через madvise,
+ *             при неудаче - Standard), страницы обнуляются параллельно (first-touch)
+ *             потоками, привязанными к CPU, блоками из целых huge pages - теми же,
+ *             что и в параллельных редукциях и поэлементных операциях. Векторы меньше
+ *             8 МБ или меньше одной huge page выделяются как Standard. Результаты
+ *             арифметических операторов и копии наследуют режим исходного вектора.
+ */
+enum class iaAllocation {
+    Standard,  ///< new double[m]()
+    HugePages  ///< huge pages + параллельная first-touch инициализация
+};
+
+/**
+ * @enum iaPageKind
+ * @brief Фактический тип страниц, полученный при выделении памяти.
+ */
+enum class iaPageKind {
+    Regular,      ///< Обычные страницы (new[] или mmap без huge pages)
+    Transparent,  ///< mmap + madvise(MADV_HUGEPAGE), THP подтверждены по AnonHugePages диапазона вектора в /proc/self/smaps
+    Explicit      ///< mmap с MAP_HUGETLB, явные huge pages
+};
 
 /**
  * @class iaVector
@@ -82,6 +119,7 @@ public:
     iaVector(); // Конструктор по умолчанию
     iaVector(int m); // Конструктор с заданным размером
     iaVector(int m, const double values[]); // Конструктор с заданным размером и значениями
+    iaVector(int m, iaAllocation mode, int threads = 0); // Конструктор с режимом выделения памяти
     iaVector(const iaVector& otherVector); // Конструктор копирования
     ~iaVector(); // Деструктор
     iaVector& operator=(const iaVector& otherVector) noexcept; // Оператор присваивания
@@ -107,6 +145,15 @@ public:
     double minElement() const; // Минимальный элемент
     double avverage() const; // Среднее значение
     
+    iaAllocation allocation() const noexcept; // Запрошенный режим выделения памяти
+    iaPageKind pageKind() const; // Фактический тип страниц
+    std::size_t pageSize() const noexcept; // Размер huge page, по которому выровнены блоки
+    bool isNodeLocal() const noexcept; // Размещены ли блоки на NUMA-узлах читающих их потоков
+    int threadCount() const noexcept; // Число потоков first-touch и редукций
+    int chunkBegin(int t) const noexcept; // Начало блока потока t
+    int chunkEnd(int t) const noexcept; // Конец блока потока t (не включительно)
+    int numaNodeOf(int j) const noexcept; // NUMA-узел страницы элемента j (-1, если неизвестно)
+    
     double& operator[](int j); // Оператор доступа к элементам вектора
     bool operator==(const iaVector& otherVector) const noexcept; // Оператор сравнения на равенство
     bool operator!=(const iaVector& otherVector) const noexcept; // Оператор сравнения на неравенство
@@ -116,6 +163,17 @@ public:
     
 private:
     int m; ///< Размер вектора
+    iaAllocation mode = iaAllocation::Standard; ///< Режим выделения памяти
+    iaPageKind pages = iaPageKind::Regular; ///< Фактический тип страниц
+    int threads = 1; ///< Число потоков (блоков) для first-touch и редукций
+    std::size_t mappedBytes = 0; ///< Размер mmap-области (0, если память выделена через new[])
+    std::size_t pageBytes = 0; ///< Размер huge page отображения (0, если память выделена через new[])
+    bool nodeLocal = false; ///< First-touch выполнен потоками, привязанными к своим CPU
+    
+    void allocate(); // Выделение памяти под m значений согласно mode
+    void release() noexcept; // Освобождение памяти согласно способу выделения
+    template <typename F> void forChunks(F body) const; // Обход блоков потоками пула
+    template <typename F, typename C> double reduce(F partial, C combine) const; // Параллельная редукция по блокам
 };
 
 #endif /* iaVector_hpp */
@@ -0,0 +1,127 @@
+/*
+ ****************************************************************************************************
+ *
+ *    Компания    : Helios Prime - Nova Terra
+ *    @file       : iaVectorTest.cpp
+ *    @brief      : Проверка режима выделения памяти iaAllocation::HugePages.
+ *    @author     : Александр Юшкевич
+ *    @project    : Базовая библиотека классов для Helios Prime - Nova Terra проектов
+ *    @license    : MIT License
+ *
+ *    @description: Сравнивает редукции и арифметические операторы векторов Standard и HugePages
+ *                   для размеров, кратных и не кратных числу потоков, и для m меньше числа
+ *                   потоков; проверяет обнуление, разбиение на блоки, numaNodeOf() и то,
+ *                   что на многоядерной машине большие векторы действительно обрабатываются
+ *                   несколькими потоками.
+ *
+ *    @build       : g++ -std=c++17 -pthread iaVectorTest.cpp iaVector.cpp -o iaVectorTest
+ * **************************************************************************************************
+ */
+
+#include "iaVector.hpp"
+
+#include <thread>
+
+static int failures = 0; ///< Число непройденных проверок
+static bool skippedParallel = false; ///< Параллельный путь не проверялся (один CPU)
+static const std::size_t parallelMinBytes = 8 * 1024 * 1024; ///< Порог параллельного режима в iaVector.cpp
+
+/**
+ * @brief Печатает сообщение и учитывает ошибку, если условие ложно.
+ */
+static void check(bool condition, const char* what, int m, int threads) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << " (m = " << m << ", threads = " << threads << ")" << std::endl;
+        failures++;
+    }
+}
+
+/**
+ * @brief Заполняет вектор целыми значениями, чтобы суммы не зависели от порядка сложения.
+ */
+static void fill(iaVector& vector) {
+    for (int i = 0; i < vector.sizeOfVector(); i++) {
+        vector.value[i] = static_cast<double>(i % 7) - 3.0;
+    }
+}
+
+/**
+ * @brief Проверяет вектор HugePages размера m против вектора Standard.
+ * @param m Размер вектора.
+ * @param threads Запрошенное число потоков (0 - по числу CPU).
+ */
+static void checkSize(int m, int threads) {
+    iaVector standard(m, iaAllocation::Standard);
+    iaVector huge(m, iaAllocation::HugePages, threads);
+    
+    bool zeros = true;
+    for (int i = 0; i < m; i++) {
+        zeros = zeros && huge.value[i] == 0.0;
+    }
+    check(zeros, "HugePages vector is not zero-initialized", m, threads);
+    
+    fill(standard);
+    fill(huge);
+    iaVector hugeCopy(huge);
+
+    check(huge.allocation() == iaAllocation::HugePages, "allocation()", m, threads);
+    check(hugeCopy.allocation() == iaAllocation::HugePages, "copy allocation()", m, threads);
+    check(huge.sum() == standard.sum(), "sum()", m, threads);
+    check(huge.L2norm() == standard.L2norm(), "L2norm()", m, threads);
+    check(huge.dotProduct(hugeCopy) == standard.dotProduct(standard), "dotProduct()", m, threads);
+    check(huge.L1norm() == standard.L1norm(), "L1norm()", m, threads);
+    check(huge.LMnorm() == standard.LMnorm(), "LMnorm()", m, threads);
+    check(huge.maxElement() == standard.maxElement(), "maxElement()", m, threads);
+    check(huge.minElement() == standard.minElement(), "minElement()", m, threads);
+    check(huge.avverage() == standard.avverage(), "avverage()", m, threads);
+
+    iaVector hugeSum = huge + hugeCopy;
+    iaVector hugeScaled = huge * 2.0;
+    check(hugeSum.allocation() == iaAllocation::HugePages, "operator+ allocation()", m, threads);
+    check(hugeSum == hugeScaled && hugeSum == standard * 2.0, "operator+ / operator*", m, threads);
+
+    int t = huge.threadCount();
+    check(t >= 1 && (threads <= 0 || t <= threads), "threadCount()", m, threads);
+    
+    std::size_t bytes = static_cast<std::size_t>(m) * sizeof(double);
+    if (bytes < parallelMinBytes) {
+        check(t == 1 && huge.pageSize() == 0, "small vector must use new[]", m, threads);
+    } else if (threads != 1 && std::thread::hardware_concurrency() > 1) {
+        check(t > 1, "parallel path did not run", m, threads);
+    } else if (threads != 1) {
+        skippedParallel = true;
+    }
+    check(huge.chunkBegin(0) == 0 && huge.chunkEnd(t - 1) == m, "chunk bounds", m, threads);
+
+    std::size_t pageElements = huge.pageSize() / sizeof(double);
+    for (int k = 0; k < t; k++) {
+        check(huge.chunkBegin(k) < huge.chunkEnd(k), "empty chunk", m, threads);
+        if (k > 0) {
+            check(huge.chunkBegin(k) == huge.chunkEnd(k - 1), "chunk gap", m, threads);
+            check(pageElements != 0 && huge.chunkBegin(k) % pageElements == 0, "chunk not page aligned", m, threads);
+        }
+    }
+
+    check(huge.numaNodeOf(-1) == -1 && huge.numaNodeOf(m) == -1, "numaNodeOf() out of range", m, threads);
+    check(huge.numaNodeOf(0) >= -1 && huge.numaNodeOf(m - 1) >= -1, "numaNodeOf()", m, threads);
+}
+
+int main() {
+    const int page = 2 * 1024 * 1024 / sizeof(double); // Элементов в 2 МБ huge page
+
+    checkSize(3, 8); // m меньше числа потоков
+    checkSize(1000, 64);
+    checkSize(4 * page, 4); // Кратно числу потоков
+    checkSize(4 * page, 0);
+    checkSize(5 * page + 12345, 4); // Не кратно числу потоков, больше 8 МБ
+    checkSize(7 * page + 1, 3);
+    checkSize(3 * page + 12345, 4); // Меньше 8 МБ: выделяется через new[]
+
+    if (skippedParallel) {
+        std::cout << "iaVectorTest: SKIP parallel path (single CPU)" << std::endl;
+    }
+    if (failures == 0) {
+        std::cout << "iaVectorTest: OK" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}